@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <chrono>
+#include <stddef.h>
+#include <stdio.h>
+
+// Unoptimized numbers would be meaningless; configurations without NDEBUG
+// (Debug, or no CMAKE_BUILD_TYPE at all) aren't optimized by default
+#ifndef NDEBUG
+#error "benchmarks must be built in an optimized (e.g. Release) configuration"
+#endif
+
+#if defined(_MSC_VER) && !defined(__INTEL_COMPILER)
+#define BENCH_noinline __declspec(noinline)
+#else
+#define BENCH_noinline __attribute__((noinline))
+#endif
+
+namespace bench_utils
+{
+
+// Results are stored here so that the measured work isn't optimized away
+inline volatile long long sink;
+
+// Runs f the given number of times and returns the fastest run in nanoseconds
+template <class F>
+inline double best_of(int reps, F &&f)
+{
+    auto best = std::chrono::nanoseconds::max();
+    while (reps--) {
+        auto const t0 = std::chrono::steady_clock::now();
+        sink          = f();
+        auto const t1 = std::chrono::steady_clock::now();
+        best          = (std::min)(
+            best, std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0));
+    }
+    return static_cast<double>(best.count());
+}
+
+inline void report(const char *name, size_t nelems, double ns)
+{
+    printf("%-40s %8.3f ns/elem %10.1f Melem/s\n", name, ns / nelems,
+           nelems * 1e3 / ns);
+}
+
+} // namespace bench_utils
@@ -0,0 +1,122 @@
+//
+// Throughput of chunked type-erased ranges versus per-element iteration
+// through a virtual function or a single-function interface.
+//
+
+#include "bench_utils.h"
+
+#include <deque>
+#include <iface_range.h>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t nelems = size_t{1} << 22;
+constexpr int nreps     = 20;
+
+//
+// Baselines: one indirect call per element
+//
+
+struct elem_iterator {
+    virtual bool next(int &out) = 0;
+};
+
+template <class R>
+struct range_iterator final : elem_iterator {
+    explicit range_iterator(R &r) : it_{std::begin(r)}, end_{std::end(r)} {}
+    bool next(int &out) override
+    {
+        if (it_ == end_)
+            return false;
+        out = *it_++;
+        return true;
+    }
+    decltype(std::begin(std::declval<R &>())) it_, end_;
+};
+
+template <class R>
+struct range_next {
+    explicit range_next(R &r) : it_{std::begin(r)}, end_{std::end(r)} {}
+    bool next(int &out)
+    {
+        if (it_ == end_)
+            return false;
+        out = *it_++;
+        return true;
+    }
+    decltype(std::begin(std::declval<R &>())) it_, end_;
+};
+
+BENCH_noinline long long sum_virtual(elem_iterator &it)
+{
+    long long s = 0;
+    for (int x; it.next(x);)
+        s += x;
+    return s;
+}
+
+BENCH_noinline long long sum_iface_next(IFACE((next, bool(int &))) it)
+{
+    long long s = 0;
+    for (int x; it.next(x);)
+        s += x;
+    return s;
+}
+
+//
+// One indirect call per chunk
+//
+
+BENCH_noinline long long sum_chunked(iface::any_range<int> r,
+                                     std::span<int> buf)
+{
+    long long s = 0;
+    for (std::span<const int> c;
+         !(c = r.next_chunk(std::span{buf})).empty();)
+        s = std::accumulate(c.begin(), c.end(), s);
+    return s;
+}
+
+template <class R>
+void run(const char *what, R &r)
+{
+    char name[64];
+    const auto report = [&](const char *how, double ns) {
+        snprintf(name, sizeof(name), "%s, %s", what, how);
+        bench_utils::report(name, nelems, ns);
+    };
+
+    report("virtual next()", bench_utils::best_of(nreps, [&] {
+               range_iterator<R> it{r};
+               return sum_virtual(it);
+           }));
+    report("IFACE next()", bench_utils::best_of(nreps, [&] {
+               range_next<R> it{r};
+               return sum_iface_next(it);
+           }));
+
+    std::vector<int> buf(4096);
+    for (size_t chunk : {16, 256, 4096}) {
+        char how[32];
+        snprintf(how, sizeof(how), "next_chunk(%zu)", chunk);
+        report(how, bench_utils::best_of(nreps, [&] {
+                   iface::range_source src{r};
+                   return sum_chunked(src, std::span{buf}.first(chunk));
+               }));
+    }
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<int> v(nelems);
+    std::iota(v.begin(), v.end(), 0);
+    std::deque<int> d(v.begin(), v.end());
+
+    run("vector (zero-copy)", v);
+    run("deque (copying)", d);
+}
@@ -0,0 +1,54 @@
+//
+// Load time of a shared library full of interface tables. Its relocation count
+// is reported by the iface-reloc-report target.
+//
+
+#include "bench_utils.h"
+
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+
+constexpr int nreps = 20;
+
+// Loads the library, calls into it (so that lazily bound symbols are resolved)
+// and unloads it again
+long long load(const char *path)
+{
+#if defined(_WIN32)
+    auto const lib = LoadLibraryA(path);
+    auto const fn  = reinterpret_cast<int (*)()>(
+        lib ? GetProcAddress(lib, "reloc_entry") : nullptr);
+#else
+    auto const lib = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    auto const fn =
+        reinterpret_cast<int (*)()>(lib ? dlsym(lib, "reloc_entry") : nullptr);
+#endif
+    if (!fn) {
+        fprintf(stderr, "couldn't load %s\n", path);
+        exit(1);
+    }
+    auto const res = fn();
+#if defined(_WIN32)
+    FreeLibrary(lib);
+#else
+    dlclose(lib);
+#endif
+    return res;
+}
+
+} // namespace
+
+int main()
+{
+    printf("%-40s %10.1f us\n", "load + call",
+           bench_utils::best_of(nreps, [] { return load(RELOC_lib); }) / 1e3);
+}
@@ -0,0 +1,20 @@
+#
+# Prints the number of relocations in a shared library. Invoked as
+#   cmake -DTOOL=<readelf|dumpbin> -DLIB=<path> -P count_relocs.cmake
+#
+
+get_filename_component(name ${LIB} NAME)
+get_filename_component(tool ${TOOL} NAME_WE)
+
+if(tool STREQUAL "readelf")
+  execute_process(COMMAND ${TOOL} --relocs --wide ${LIB} OUTPUT_VARIABLE out)
+  string(REGEX MATCHALL "\n[0-9a-f]+ +[0-9a-f]+ +R_" relocs "${out}")
+elseif(tool STREQUAL "dumpbin")
+  execute_process(COMMAND ${TOOL} /relocations ${LIB} OUTPUT_VARIABLE out)
+  string(REGEX MATCHALL " (DIR64|HIGHLOW) " relocs "${out}")
+else()
+  message(FATAL_ERROR "no readelf or dumpbin found; can't count relocations")
+endif()
+
+list(LENGTH relocs n)
+message("${name}: ${n} relocations")
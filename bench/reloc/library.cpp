@@ -0,0 +1,49 @@
+//
+// A shared library holding RELOC_ntables interface tables of four functions,
+// loaded by bench/reloc.cpp.
+//
+
+#include "../bench_utils.h"
+
+#include <iface.h>
+#include <utility>
+
+#if defined(_WIN32)
+#define RELOC_export extern "C" __declspec(dllexport)
+#else
+#define RELOC_export extern "C" __attribute__((visibility("default")))
+#endif
+
+namespace
+{
+
+template <int I>
+struct impl {
+    int f() const { return I; }
+    int g() const { return I + 1; }
+    int h() const { return I + 2; }
+    int k() const { return I + 3; }
+};
+
+using If = IFACE((f, int() const)(g, int() const)(h, int() const)(
+    k, int() const));
+
+BENCH_noinline int call(If x) { return x.k(); }
+
+// Results are collected via an initializer list as an array of pointers to
+// functions would add relocations of its own
+template <int... Is>
+int call_all(std::integer_sequence<int, Is...>)
+{
+    int res = 0;
+    for (int x : {call(impl<Is>{})...})
+        res += x;
+    return res;
+}
+
+} // namespace
+
+RELOC_export int reloc_entry()
+{
+    return call_all(std::make_integer_sequence<int, RELOC_ntables>{});
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "iface.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace iface
+{
+
+//
+// Type-erased ranges hand over elements in chunks rather than one at a time,
+// so that the cost of an indirect call is paid once per batch. A source is
+// given a buffer to fill and returns the chunk it produced: either a prefix of
+// that buffer, or - if it can - a view directly into its own storage, in which
+// case nothing is copied. An empty chunk means the source is exhausted, so the
+// buffer passed in must not be empty.
+//
+// The interfaces are member types of a class template rather than IFACE used
+// directly in an alias template; each use of the latter may denote a distinct
+// type, whereas any_range<int> has to name one type for a function to be
+// declared and defined separately. The element type parameter isn't called T
+// as IFACE already uses that name for the implementing class.
+//
+
+namespace detail
+{
+template <class Elem>
+struct range_ifaces {
+    using range = IFACE((next_chunk, std::span<const Elem>(std::span<Elem>)));
+    using sink  = IFACE((put_chunk, void(std::span<const Elem>)));
+};
+} // namespace detail
+
+template <class Elem>
+using any_range = typename detail::range_ifaces<Elem>::range;
+
+template <class Elem>
+using any_sink = typename detail::range_ifaces<Elem>::sink;
+
+//
+// Adapters from C++20 ranges and output iterators. The adaptee is referred to
+// via iterators, hence it must outlive the adapter (and the adapter must
+// outlive the interface it's lifted into).
+//
+
+template <std::ranges::input_range R,
+          class Elem = std::ranges::range_value_t<R>>
+requires std::ranges::borrowed_range<R> //
+    class range_source
+{
+    static constexpr bool zero_copy =
+        std::ranges::contiguous_range<R> &&
+        std::sized_sentinel_for<std::ranges::sentinel_t<R>,
+                                std::ranges::iterator_t<R>> &&
+        std::is_same_v<std::ranges::range_value_t<R>, Elem>;
+
+  public:
+    explicit constexpr IFACE_inline range_source(R &&r)
+        : it_{std::ranges::begin(r)}, end_{std::ranges::end(r)}
+    {
+    }
+
+    constexpr IFACE_inline std::span<const Elem>
+    next_chunk(std::span<Elem> buf)
+    {
+        if constexpr (zero_copy) {
+            auto const n = (std::min)(buf.size(),
+                                      static_cast<std::size_t>(end_ - it_));
+            std::span<const Elem> chunk{std::to_address(it_), n};
+            it_ += n;
+            return chunk;
+        } else {
+            std::size_t n = 0;
+            for (; n < buf.size() && it_ != end_; ++it_)
+                buf[n++] = static_cast<Elem>(*it_);
+            return buf.first(n);
+        }
+    }
+
+  private:
+    std::ranges::iterator_t<R> it_;
+    std::ranges::sentinel_t<R> end_;
+};
+
+template <class R>
+range_source(R &&) -> range_source<R>;
+
+template <class O>
+class iterator_sink
+{
+  public:
+    explicit constexpr IFACE_inline iterator_sink(O out) : out_{std::move(out)}
+    {
+    }
+
+    template <class Elem>
+    requires std::output_iterator<O, const Elem &> //
+        constexpr IFACE_inline void put_chunk(std::span<const Elem> chunk)
+    {
+        out_ = std::ranges::copy(chunk, std::move(out_)).out;
+    }
+
+    constexpr IFACE_inline const O &base() const noexcept { return out_; }
+
+  private:
+    O out_;
+};
+
+//
+// Moves all elements from a source to a sink, one chunk at a time. Works with
+// any_range/any_sink and with the adapters above alike.
+//
+
+template <class Source, class Sink, class Elem>
+constexpr void drain(Source &&src, Sink &&dst, std::span<Elem> buf)
+{
+    assert(!buf.empty() && "an empty chunk would read as exhaustion");
+    for (std::span<const Elem> chunk;
+         !(chunk = src.next_chunk(std::span{buf})).empty();)
+        dst.put_chunk(std::span{chunk});
+}
+
+template <class Source, class Sink, std::ranges::contiguous_range Buf>
+constexpr void drain(Source &&src, Sink &&dst, Buf &&buf)
+{
+    drain(static_cast<Source &&>(src), static_cast<Sink &&>(dst),
+          std::span<std::ranges::range_value_t<Buf>>{buf});
+}
+
+} // namespace iface
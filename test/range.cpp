@@ -0,0 +1,164 @@
+//
+// Tests for chunked type-erased ranges and sinks.
+//
+
+#include "test_utils.h"
+
+#include <iface_range.h>
+#include <list>
+#include <vector>
+
+// Declared and defined separately, as across a module boundary
+long long sum_range(iface::any_range<int> r);
+void fill_sink(iface::any_sink<int> s);
+
+int main(int, char **argv)
+{
+    int nassertions = 0;
+
+    //
+    // Contiguous ranges are handed out without copying, in chunks no larger
+    // than the buffer
+    //
+    {
+        std::vector<int> v{1, 2, 3, 4, 5};
+        int buf[2]{};
+        iface::range_source src{v};
+        iface::any_range<int> r = src;
+        auto c1 = r.next_chunk(buf);
+        ASSERT(c1.data() == v.data());
+        ASSERT(c1.size() == 2u);
+        auto c2 = r.next_chunk(buf);
+        ASSERT(c2.data() == v.data() + 2);
+        ASSERT(c2.size() == 2u);
+        auto c3 = r.next_chunk(buf);
+        ASSERT(c3.data() == v.data() + 4);
+        ASSERT(c3.size() == 1u);
+        ASSERT_TRUE(r.next_chunk(buf).empty());
+        ASSERT(buf[0] == 0);
+    }
+
+    //
+    // Non-contiguous ranges are copied into the buffer
+    //
+    {
+        std::list<int> l{1, 2, 3};
+        int buf[2]{};
+        iface::range_source src{l};
+        iface::any_range<int> r = src;
+        auto c1 = r.next_chunk(buf);
+        ASSERT(c1.data() == buf);
+        ASSERT(c1.size() == 2u);
+        ASSERT(buf[0] == 1);
+        ASSERT(buf[1] == 2);
+        auto c2 = r.next_chunk(buf);
+        ASSERT(c2.size() == 1u);
+        ASSERT(buf[0] == 3);
+        ASSERT_TRUE(r.next_chunk(buf).empty());
+    }
+
+    //
+    // Elements are converted when the range's value type differs
+    //
+    {
+        std::vector<short> v{1, 2, 3};
+        int buf[4]{};
+        iface::range_source<std::vector<short> &, int> src{v};
+        iface::any_range<int> r = src;
+        auto c = r.next_chunk(buf);
+        ASSERT(c.data() == buf);
+        ASSERT(c.size() == 3u);
+        ASSERT(buf[2] == 3);
+    }
+
+    //
+    // Views are accepted as long as their iterators don't dangle
+    //
+    {
+        iface::range_source src{std::views::iota(0, 10)};
+        iface::any_range<int> r = src;
+        int buf[4]{};
+        int sum = 0;
+        for (std::span<const int> c; !(c = r.next_chunk(buf)).empty();)
+            for (auto x : c)
+                sum += x;
+        ASSERT(sum == 45);
+    }
+
+    //
+    // Sinks receive whole chunks
+    //
+    {
+        std::vector<int> out;
+        iface::iterator_sink dst{std::back_inserter(out)};
+        iface::any_sink<int> s = dst;
+        const int xs[]{1, 2, 3};
+        s.put_chunk(xs);
+        s.put_chunk(std::span{xs}.first(1));
+        ASSERT(out.size() == 4u);
+        ASSERT(out[2] == 3);
+        ASSERT(out[3] == 1);
+    }
+
+    //
+    // Draining moves every element across, through interfaces or not
+    //
+    {
+        std::list<int> l{1, 2, 3, 4, 5, 6, 7};
+        std::vector<int> out;
+        int buf[3];
+        iface::range_source src{l};
+        iface::iterator_sink dst{std::back_inserter(out)};
+        iface::drain(iface::any_range<int>{src}, iface::any_sink<int>{dst},
+                     buf);
+        ASSERT(out.size() == 7u);
+        ASSERT(out[6] == 7);
+
+        std::vector<int> out2(out.size());
+        iface::range_source src2{out};
+        iface::iterator_sink dst2{out2.begin()};
+        iface::drain(src2, dst2, buf);
+        ASSERT(dst2.base() == out2.end());
+        ASSERT(out2 == out);
+    }
+
+    //
+    // Each use of any_range<T> and any_sink<T> names the same type
+    //
+    {
+        static_assert(
+            std::is_same_v<iface::any_range<int>, iface::any_range<int>>);
+        static_assert(
+            std::is_same_v<iface::any_sink<int>, iface::any_sink<int>>);
+        std::vector<int> v{1, 2, 3};
+        iface::range_source src{v};
+        ASSERT(sum_range(src) == 6);
+        std::vector<int> out;
+        iface::iterator_sink dst{std::back_inserter(out)};
+        fill_sink(dst);
+        ASSERT(out.size() == 2u);
+    }
+
+    printf("%s: ",
+           [&](auto x) { return x ? x + 1 : argv[0]; }(strrchr(argv[0], '\\')));
+    printf("\u001b[32;1m%d assertion%s OK\u001b[0m\n", nassertions,
+           nassertions == 1 ? "" : "s");
+
+    return 0;
+}
+
+long long sum_range(iface::any_range<int> r)
+{
+    int buf[2];
+    long long sum = 0;
+    for (std::span<const int> c; !(c = r.next_chunk(buf)).empty();)
+        for (auto x : c)
+            sum += x;
+    return sum;
+}
+
+void fill_sink(iface::any_sink<int> s)
+{
+    const int xs[]{4, 5};
+    s.put_chunk(xs);
+}